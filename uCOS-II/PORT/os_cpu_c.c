@@ -1,313 +1,356 @@
-/*
-*********************************************************************************************************
-*                                               uC/OS-II
-*                                         The Real-Time Kernel
-*
-*
-*                                (c) Copyright 2006, Micrium, Weston, FL
-*                                          All Rights Reserved
-*
-*                                           ARM Cortex-M3 Port
-*
-* File      : OS_CPU_C.C
-* Version   : V2.86
-* By        : Jean J. Labrosse
-*
-* For       : ARMv7M Cortex-M3
-* Mode      : Thumb2
-* Toolchain : RealView Development Suite
-*             RealView Microcontroller Development Kit (MDK)
-*             ARM Developer Suite (ADS)
-*             Keil uVision
-*********************************************************************************************************
-*/
-
-#define  OS_CPU_GLOBALS
-
-#include "includes.h"
-/*
-*********************************************************************************************************
-*                                          LOCAL VARIABLES
-*********************************************************************************************************
-*/
-
-#if OS_TMR_EN > 0
-static  INT16U  OSTmrCtr;
-#endif
-
-
-/*
-*********************************************************************************************************
-*                                       OS INITIALIZATION HOOK
-*                                            (BEGINNING)
-*
-* Description: This function is called by OSInit() at the beginning of OSInit().
-*
-* Arguments  : none
-*
-* Note(s)    : 1) Interrupts should be disabled during this call.
-*********************************************************************************************************
-*/
-#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
-void  OSInitHookBegin (void)
-{
-#if OS_TMR_EN > 0
-    OSTmrCtr = 0;
-#endif
-}
-#endif
-
-/*
-*********************************************************************************************************
-*                                       OS INITIALIZATION HOOK
-*                                               (END)
-*
-* Description: This function is called by OSInit() at the end of OSInit().
-*
-* Arguments  : none
-*
-* Note(s)    : 1) Interrupts should be disabled during this call.
-*********************************************************************************************************
-*/
-#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
-void  OSInitHookEnd (void)
-{
-}
-#endif
-
-/*
-*********************************************************************************************************
-*                                          TASK CREATION HOOK
-*
-* Description: This function is called when a task is created.
-*
-* Arguments  : ptcb   is a pointer to the task control block of the task being created.
-*
-* Note(s)    : 1) Interrupts are disabled during this call.
-*********************************************************************************************************
-*/
-#if OS_CPU_HOOKS_EN > 0
-void  OSTaskCreateHook (OS_TCB *ptcb)
-{
-#if OS_APP_HOOKS_EN > 0
-    App_TaskCreateHook(ptcb);
-#else
-    (void)ptcb;                                  /* Prevent compiler warning                           */
-#endif
-}
-#endif
-
-
-/*
-*********************************************************************************************************
-*                                           TASK DELETION HOOK
-*
-* Description: This function is called when a task is deleted.
-*
-* Arguments  : ptcb   is a pointer to the task control block of the task being deleted.
-*
-* Note(s)    : 1) Interrupts are disabled during this call.
-*********************************************************************************************************
-*/
-#if OS_CPU_HOOKS_EN > 0
-void  OSTaskDelHook (OS_TCB *ptcb)
-{
-#if OS_APP_HOOKS_EN > 0
-    App_TaskDelHook(ptcb);
-#else
-    (void)ptcb;                                  /* Prevent compiler warning                           */
-#endif
-}
-#endif
-
-/*
-*********************************************************************************************************
-*                                             IDLE TASK HOOK
-*
-* Description: This function is called by the idle task.  This hook has been added to allow you to do
-*              such things as STOP the CPU to conserve power.
-*
-* Arguments  : none
-*
-* Note(s)    : 1) Interrupts are enabled during this call.
-*********************************************************************************************************
-*/
-#if OS_CPU_HOOKS_EN > 0 && OS_VERSION >= 251
-void  OSTaskIdleHook (void)
-{
-#if OS_APP_HOOKS_EN > 0
-    App_TaskIdleHook();
-#endif
-}
-#endif
-
-/*
-*********************************************************************************************************
-*                                           STATISTIC TASK HOOK
-*
-* Description: This function is called every second by uC/OS-II's statistics task.  This allows your
-*              application to add functionality to the statistics task.
-*
-* Arguments  : none
-*********************************************************************************************************
-*/
-
-#if OS_CPU_HOOKS_EN > 0
-void  OSTaskStatHook (void)
-{
-#if OS_APP_HOOKS_EN > 0
-    App_TaskStatHook();
-#endif
-}
-#endif
-
-/*
-*********************************************************************************************************
-*                                        INITIALIZE A TASK'S STACK
-*
-* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
-*              stack frame of the task being created.  This function is highly processor specific.
-*
-* Arguments  : task          is a pointer to the task code
-*
-*              p_arg         is a pointer to a user supplied data area that will be passed to the task
-*                            when the task first executes.
-*
-*              ptos          is a pointer to the top of stack.  It is assumed that 'ptos' points to
-*                            a 'free' entry on the task stack.  If OS_STK_GROWTH is set to 1 then
-*                            'ptos' will contain the HIGHEST valid address of the stack.  Similarly, if
-*                            OS_STK_GROWTH is set to 0, the 'ptos' will contains the LOWEST valid address
-*                            of the stack.
-*
-*              opt           specifies options that can be used to alter the behavior of OSTaskStkInit().
-*                            (see uCOS_II.H for OS_TASK_OPT_xxx).
-*
-* Returns    : Always returns the location of the new top-of-stack once the processor registers have
-*              been placed on the stack in the proper order.
-*
-* Note(s)    : 1) Interrupts are enabled when your task starts executing.
-*              2) All tasks run in Thread mode, using process stack.
-*********************************************************************************************************
-*/
-
-OS_STK *OSTaskStkInit (void (*task)(void *p_arg), void *p_arg, OS_STK *ptos, INT16U opt)
-{
-    OS_STK *stk;
-
-
-    (void)opt;                                   /* 'opt' is not used, prevent warning                 */
-    stk       = ptos;                            /* Load stack pointer                                 */
-
-                                                 /* Registers stacked as if auto-saved on exception    */
-    *(stk)    = (INT32U)0x01000000L;             /* xPSR                                               */
-    *(--stk)  = (INT32U)task;                    /* Entry Point                                        */
-    *(--stk)  = (INT32U)0xFFFFFFFEL;             /* R14 (LR) (init value will cause fault if ever used)*/
-    *(--stk)  = (INT32U)0x12121212L;             /* R12                                                */
-    *(--stk)  = (INT32U)0x03030303L;             /* R3                                                 */
-    *(--stk)  = (INT32U)0x02020202L;             /* R2                                                 */
-    *(--stk)  = (INT32U)0x01010101L;             /* R1                                                 */
-    *(--stk)  = (INT32U)p_arg;                   /* R0 : argument                                      */
-
-                                                 /* Remaining registers saved on process stack         */
-    *(--stk)  = (INT32U)0x11111111L;             /* R11                                                */
-    *(--stk)  = (INT32U)0x10101010L;             /* R10                                                */
-    *(--stk)  = (INT32U)0x09090909L;             /* R9                                                 */
-    *(--stk)  = (INT32U)0x08080808L;             /* R8                                                 */
-    *(--stk)  = (INT32U)0x07070707L;             /* R7                                                 */
-    *(--stk)  = (INT32U)0x06060606L;             /* R6                                                 */
-    *(--stk)  = (INT32U)0x05050505L;             /* R5                                                 */
-    *(--stk)  = (INT32U)0x04040404L;             /* R4                                                 */
-
-    return (stk);
-}
-
-/*
-*********************************************************************************************************
-*                                           TASK SWITCH HOOK
-*
-* Description: This function is called when a task switch is performed.  This allows you to perform other
-*              operations during a context switch.
-*
-* Arguments  : none
-*
-* Note(s)    : 1) Interrupts are disabled during this call.
-*              2) It is assumed that the global pointer 'OSTCBHighRdy' points to the TCB of the task that
-*                 will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCur' points to the
-*                 task being switched out (i.e. the preempted task).
-*********************************************************************************************************
-*/
-#if (OS_CPU_HOOKS_EN > 0) && (OS_TASK_SW_HOOK_EN > 0)
-void  OSTaskSwHook (void)
-{
-#if OS_APP_HOOKS_EN > 0
-    App_TaskSwHook();
-#endif
-}
-#endif
-
-/*
-*********************************************************************************************************
-*                                           OS_TCBInit() HOOK
-*
-* Description: This function is called by OS_TCBInit() after setting up most of the TCB.
-*
-* Arguments  : ptcb    is a pointer to the TCB of the task being created.
-*
-* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
-*********************************************************************************************************
-*/
-#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
-void  OSTCBInitHook (OS_TCB *ptcb)
-{
-#if OS_APP_HOOKS_EN > 0
-    App_TCBInitHook(ptcb);
-#else
-    (void)ptcb;                                  /* Prevent compiler warning                           */
-#endif
-}
-#endif
-
-
-/*
-*********************************************************************************************************
-*                                               TICK HOOK
-*
-* Description: This function is called every tick.
-*
-* Arguments  : none
-*
-* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
-*********************************************************************************************************
-*/
-#if (OS_CPU_HOOKS_EN > 0) && (OS_TIME_TICK_HOOK_EN > 0)
-void  OSTimeTickHook (void)
-{
-#if OS_APP_HOOKS_EN > 0
-    App_TimeTickHook();
-#endif
-
-#if OS_TMR_EN > 0
-    OSTmrCtr++;
-    if (OSTmrCtr >= (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)) {
-        OSTmrCtr = 0;
-        OSTmrSignal();
-    }
-#endif
-}
-#endif
-
-#if OS_CPU_HOOKS_EN > 0u && OS_VERSION > 290u 
-
-void OSTaskReturnHook(OS_TCB *ptcb)
-{ 
-	(void)ptcb; 
-} 
-
-#endif
-
-
-
-
-
-
-/*----------------------- (C) COPYRIGHT @ 2012 liycobl -----------------  end of file -----------------*/
+/*
+*********************************************************************************************************
+*                                               uC/OS-II
+*                                         The Real-Time Kernel
+*
+*
+*                                (c) Copyright 2006, Micrium, Weston, FL
+*                                          All Rights Reserved
+*
+*                                           ARM Cortex-M3 Port
+*
+* File      : OS_CPU_C.C
+* Version   : V2.86
+* By        : Jean J. Labrosse
+*
+* For       : ARMv7M Cortex-M3
+* Mode      : Thumb2
+* Toolchain : RealView Development Suite
+*             RealView Microcontroller Development Kit (MDK)
+*             ARM Developer Suite (ADS)
+*             Keil uVision
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_GLOBALS
+
+#include "includes.h"
+/*
+*********************************************************************************************************
+*                                          LOCAL VARIABLES
+*********************************************************************************************************
+*/
+
+#if OS_TMR_EN > 0
+static  INT16U  OSTmrCtr;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*                                            (BEGINNING)
+*
+* Description: This function is called by OSInit() at the beginning of OSInit().
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts should be disabled during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
+void  OSInitHookBegin (void)
+{
+#if OS_TMR_EN > 0
+    OSTmrCtr = 0;
+#endif
+#if (OS_CRIT_PROF_EN > 0) || (OS_TASK_PROF_EN > 0) || (OS_TRACE_EN > 0)
+    OSCPUTsInit();                                /* Start the timestamp of the profilers and the trace   */
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                       START THE CYCLE COUNTER
+*
+* Description: This function enables the DWT cycle counter read by OSCPUTsGet().
+*
+* Arguments  : none
+*********************************************************************************************************
+*/
+void  OSCPUTsInit (void)
+{
+    OS_CPU_DEMCR       |= 0x01000000;             /* TRCENA: enable the DWT                               */
+    OS_CPU_DWT_CYCCNT   = 0;
+    OS_CPU_DWT_CTRL    |= 0x00000001;             /* CYCCNTENA: start counting CPU cycles                 */
+}
+
+/*
+*********************************************************************************************************
+*                                       OS INITIALIZATION HOOK
+*                                               (END)
+*
+* Description: This function is called by OSInit() at the end of OSInit().
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts should be disabled during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
+void  OSInitHookEnd (void)
+{
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                          TASK CREATION HOOK
+*
+* Description: This function is called when a task is created.
+*
+* Arguments  : ptcb   is a pointer to the task control block of the task being created.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0
+void  OSTaskCreateHook (OS_TCB *ptcb)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TaskCreateHook(ptcb);
+#else
+    (void)ptcb;                                  /* Prevent compiler warning                           */
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           TASK DELETION HOOK
+*
+* Description: This function is called when a task is deleted.
+*
+* Arguments  : ptcb   is a pointer to the task control block of the task being deleted.
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0
+void  OSTaskDelHook (OS_TCB *ptcb)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TaskDelHook(ptcb);
+#else
+    (void)ptcb;                                  /* Prevent compiler warning                           */
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                             IDLE TASK HOOK
+*
+* Description: This function is called by the idle task.  This hook has been added to allow you to do
+*              such things as STOP the CPU to conserve power.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are enabled during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_VERSION >= 251
+void  OSTaskIdleHook (void)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TaskIdleHook();
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                           STATISTIC TASK HOOK
+*
+* Description: This function is called every second by uC/OS-II's statistics task.  This allows your
+*              application to add functionality to the statistics task.
+*
+* Arguments  : none
+*********************************************************************************************************
+*/
+
+#if OS_CPU_HOOKS_EN > 0
+void  OSTaskStatHook (void)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TaskStatHook();
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                          STACK USAGE ALERT HOOK
+*
+* Description: This function is called when the stack high-water mark of a task reaches
+*              OS_TASK_STK_WM_ALERT percent of its stack.  It is called once per task.
+*
+* Arguments  : ptcb   is a pointer to the task control block of the task.  ptcb->OSTCBStkUsed is the
+*                     number of stack entries used so far.
+*
+* Note(s)    : 1) Interrupts are enabled during this call.
+*              2) This function is called by the statistic task or by OSTaskStkChk().
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_TASK_STK_WM_EN > 0
+void  OSTaskStkAlertHook (OS_TCB *ptcb)
+{
+    (void)ptcb;                                  /* Prevent compiler warning                           */
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                        INITIALIZE A TASK'S STACK
+*
+* Description: This function is called by either OSTaskCreate() or OSTaskCreateExt() to initialize the
+*              stack frame of the task being created.  This function is highly processor specific.
+*
+* Arguments  : task          is a pointer to the task code
+*
+*              p_arg         is a pointer to a user supplied data area that will be passed to the task
+*                            when the task first executes.
+*
+*              ptos          is a pointer to the top of stack.  It is assumed that 'ptos' points to
+*                            a 'free' entry on the task stack.  If OS_STK_GROWTH is set to 1 then
+*                            'ptos' will contain the HIGHEST valid address of the stack.  Similarly, if
+*                            OS_STK_GROWTH is set to 0, the 'ptos' will contains the LOWEST valid address
+*                            of the stack.
+*
+*              opt           specifies options that can be used to alter the behavior of OSTaskStkInit().
+*                            (see uCOS_II.H for OS_TASK_OPT_xxx).
+*
+* Returns    : Always returns the location of the new top-of-stack once the processor registers have
+*              been placed on the stack in the proper order.
+*
+* Note(s)    : 1) Interrupts are enabled when your task starts executing.
+*              2) All tasks run in Thread mode, using process stack.
+*********************************************************************************************************
+*/
+
+OS_STK *OSTaskStkInit (void (*task)(void *p_arg), void *p_arg, OS_STK *ptos, INT16U opt)
+{
+    OS_STK *stk;
+
+
+    (void)opt;                                   /* 'opt' is not used, prevent warning                 */
+    stk       = ptos;                            /* Load stack pointer                                 */
+
+                                                 /* Registers stacked as if auto-saved on exception    */
+    *(stk)    = (INT32U)0x01000000L;             /* xPSR                                               */
+    *(--stk)  = (INT32U)task;                    /* Entry Point                                        */
+    *(--stk)  = (INT32U)0xFFFFFFFEL;             /* R14 (LR) (init value will cause fault if ever used)*/
+    *(--stk)  = (INT32U)0x12121212L;             /* R12                                                */
+    *(--stk)  = (INT32U)0x03030303L;             /* R3                                                 */
+    *(--stk)  = (INT32U)0x02020202L;             /* R2                                                 */
+    *(--stk)  = (INT32U)0x01010101L;             /* R1                                                 */
+    *(--stk)  = (INT32U)p_arg;                   /* R0 : argument                                      */
+
+                                                 /* Remaining registers saved on process stack         */
+    *(--stk)  = (INT32U)0x11111111L;             /* R11                                                */
+    *(--stk)  = (INT32U)0x10101010L;             /* R10                                                */
+    *(--stk)  = (INT32U)0x09090909L;             /* R9                                                 */
+    *(--stk)  = (INT32U)0x08080808L;             /* R8                                                 */
+    *(--stk)  = (INT32U)0x07070707L;             /* R7                                                 */
+    *(--stk)  = (INT32U)0x06060606L;             /* R6                                                 */
+    *(--stk)  = (INT32U)0x05050505L;             /* R5                                                 */
+    *(--stk)  = (INT32U)0x04040404L;             /* R4                                                 */
+
+    return (stk);
+}
+
+/*
+*********************************************************************************************************
+*                                           TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are disabled during this call.
+*              2) It is assumed that the global pointer 'OSTCBHighRdy' points to the TCB of the task that
+*                 will be 'switched in' (i.e. the highest priority task) and, 'OSTCBCur' points to the
+*                 task being switched out (i.e. the preempted task).
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0) && (OS_TASK_SW_HOOK_EN > 0)
+void  OSTaskSwHook (void)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TaskSwHook();
+#endif
+#if OS_TASK_PROF_EN > 0
+    OS_TaskSwProf();                              /* Charge the run time of the task switched out         */
+#endif
+}
+#endif
+
+/*
+*********************************************************************************************************
+*                                           OS_TCBInit() HOOK
+*
+* Description: This function is called by OS_TCBInit() after setting up most of the TCB.
+*
+* Arguments  : ptcb    is a pointer to the TCB of the task being created.
+*
+* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
+*********************************************************************************************************
+*/
+#if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
+void  OSTCBInitHook (OS_TCB *ptcb)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TCBInitHook(ptcb);
+#else
+    (void)ptcb;                                  /* Prevent compiler warning                           */
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                               TICK HOOK
+*
+* Description: This function is called every tick.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts may or may not be ENABLED during this call.
+*********************************************************************************************************
+*/
+#if (OS_CPU_HOOKS_EN > 0) && (OS_TIME_TICK_HOOK_EN > 0)
+void  OSTimeTickHook (void)
+{
+#if OS_APP_HOOKS_EN > 0
+    App_TimeTickHook();
+#endif
+
+#if OS_TMR_EN > 0
+    OSTmrCtr++;
+    if (OSTmrCtr >= (OS_TICKS_PER_SEC / OS_TMR_CFG_TICKS_PER_SEC)) {
+        OSTmrCtr = 0;
+        OSTmrSignal();
+    }
+#endif
+}
+#endif
+
+#if OS_CPU_HOOKS_EN > 0u && OS_VERSION > 290u 
+
+void OSTaskReturnHook(OS_TCB *ptcb)
+{ 
+	(void)ptcb; 
+} 
+
+#endif
+
+
+
+
+
+
+/*----------------------- (C) COPYRIGHT @ 2012 liycobl -----------------  end of file -----------------*/